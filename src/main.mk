@@ -110,5 +110,11 @@ SUBMAKEFILES += meryl2/meryl.mk \
 
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += tests/merylCountArrayTest.mk \
-                tests/merylExactLookupTest.mk
+                tests/merylCountArray2Test.mk \
+                tests/merylCountPartitionedTest.mk \
+                tests/merylExactLookupTest.mk \
+                tests/merylLookupIndexTest.mk \
+                tests/merylMergeTest.mk \
+                tests/merylOpComputeTest.mk \
+                tests/merylSuperKmerTest.mk
 endif
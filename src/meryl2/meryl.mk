@@ -11,13 +11,15 @@ SOURCES  := meryl.C \
             merylInput.C \
             merylOp-count-memorySize.C \
             merylOp-count.C \
+            merylOp-countPartitioned.C \
             merylOp-countSequential.C \
             merylOp-countSimple.C \
             merylOp-countThreads.C \
             merylOp-nextMer.C \
             merylOp.C \
             merylOpCompute.C \
-            merylOpTemplate.C
+            merylOpTemplate.C \
+            merylSuperKmer.C
 
 SRC_INCDIRS := .
 
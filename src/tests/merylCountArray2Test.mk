@@ -0,0 +1,8 @@
+TARGET   := merylCountArray2Test
+SOURCES  := merylCountArray2Test.C ../meryl2/merylCountArray.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl2
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,28 @@
+TARGET   := merylCountPartitionedTest
+SOURCES  := merylCountPartitionedTest.C \
+            ../meryl2/merylCommandBuilder-isAlias.C \
+            ../meryl2/merylCommandBuilder-isFilter.C \
+            ../meryl2/merylCommandBuilder-isOption.C \
+            ../meryl2/merylCommandBuilder-isSelect.C \
+            ../meryl2/merylCommandBuilder-processWord.C \
+            ../meryl2/merylCommandBuilder.C \
+            ../meryl2/merylCountArray.C \
+            ../meryl2/merylFilter.C \
+            ../meryl2/merylInput.C \
+            ../meryl2/merylOp-count-memorySize.C \
+            ../meryl2/merylOp-count.C \
+            ../meryl2/merylOp-countPartitioned.C \
+            ../meryl2/merylOp-countSequential.C \
+            ../meryl2/merylOp-countSimple.C \
+            ../meryl2/merylOp-countThreads.C \
+            ../meryl2/merylOp-nextMer.C \
+            ../meryl2/merylOp.C \
+            ../meryl2/merylOpCompute.C \
+            ../meryl2/merylOpTemplate.C \
+            ../meryl2/merylSuperKmer.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl2
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,9 @@
+TARGET   := merylLookupIndexTest
+SOURCES  := merylLookupIndexTest.C \
+            ../meryl2-lookup/lookup-index.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl2-lookup
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,9 @@
+TARGET   := merylSuperKmerTest
+SOURCES  := merylSuperKmerTest.C \
+            ../meryl2/merylSuperKmer.C
+
+SRC_INCDIRS  := . ../utility/src ../meryl2
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a